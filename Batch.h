@@ -0,0 +1,39 @@
+/**
+ * File: Batch.h
+ *
+ * Authors: Benjamin David Mayes <bdm8233@rit.edu>
+ *          Colin Alexander Barr <colin.a.barr@gmail.com>
+ *
+ * Description: Declarations for the batch runner, which runs many programs on
+ * the fast execution engine across a pool of worker threads.
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "globals.h"
+#include "ControlStore.h"
+
+// the result a batch job stops with when it runs out of instructions
+#define BATCH_LIMIT -1
+
+// A program to run, along with object files loaded over it before it starts
+struct BatchJob {
+  string program;
+  list<string> overlays;
+
+  // filled in once the job has run
+  int result;           // the error the CPU stopped with, or BATCH_LIMIT
+  uint64 instructions;
+  uint64 cycles;
+};
+
+// reads a batch list, one job per line: a program followed by its overlays
+uint32 load_batch(const char * file, BatchJob ** jobs);
+
+// runs every job on the given number of threads, all sharing one control store,
+// through the block cache or translating every instruction as it runs
+void run_batch(BatchJob * jobs, uint32 count, uint32 threads, uint64 limit, bool cached,
+               const ControlStore & control);
+
+#endif
@@ -0,0 +1,108 @@
+/**
+ * File: Cache.h
+ *
+ * Authors: Benjamin David Mayes <bdm8233@rit.edu>
+ *          Colin Alexander Barr <colin.a.barr@gmail.com>
+ *
+ * Description: Declarations for the cache model, a configurable hierarchy of
+ * caches that main memory accesses are timed through.
+ */
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#include "globals.h"
+
+// Kinds of memory access
+#define ACCESS_INST  0  // instruction words, and the index words after them
+#define ACCESS_AM    1  // address mode operands and the pointers to them
+#define ACCESS_DATA  2  // the stack, and results written back
+#define ACCESS_KINDS 3
+
+// Replacement policies
+#define REPLACE_LRU    0
+#define REPLACE_FIFO   1
+#define REPLACE_RANDOM 2
+
+// Write policies
+#define WRITE_BACK    0 // write allocate, dirty lines written out when evicted
+#define WRITE_THROUGH 1 // no write allocate, every write goes to the next level
+
+// A single set associative cache. Sizes are in words.
+class Cache {
+private:
+  uint32 line_bits;
+  uint32 set_mask;
+  uint32 ways;
+  uint32 replace;
+  uint32 write_policy;
+
+  // the tag, whether valid and dirty, and the last use (LRU) or fill (FIFO)
+  // of each line, set by set
+  uint32 * tags;
+  byte * state;
+  uint64 * used;
+  uint64 clock;
+  uint32 seed;
+
+  // where misses go: the next level, or main memory
+  Cache * next;
+  uint32 memory_latency;
+
+  uint32 below(uint32 addr, byte kind, bool write);
+  uint32 * find(uint32 line);
+  void fill(uint32 line, bool dirty);
+
+public:
+  string name;
+  uint32 size, line, latency;
+  uint64 hits[ACCESS_KINDS];
+  uint64 misses[ACCESS_KINDS];
+  uint64 writebacks;
+
+  Cache(const string & name, uint32 size, uint32 line, uint32 ways, uint32 latency,
+        uint32 replace, uint32 write_policy, Cache * next, uint32 memory_latency);
+  ~Cache();
+  uint32 access(uint32 addr, byte kind, bool write);
+  void writeBack(uint32 addr);
+};
+
+// The caches in front of main memory: a unified or split first level and an
+// optional second level, configured from a list such as
+//
+//   l1i=512/4/1,l1d=512/4/2/lru/wb,l2=4096/8/4/6,mem=20
+//
+// Each level is SIZE/LINE/WAYS in words, optionally followed by its hit
+// latency in ticks, lru, fifo or random, and wb or wt. Levels that are left
+// out are skipped over.
+class CacheHierarchy {
+private:
+  Cache * levels[3];    // l1i (or unified l1), l1d, l2
+  Cache * top[2];       // where instruction and other accesses start
+  uint32 memory_latency;
+public:
+  // ticks accesses took beyond the one the CPU already spends on each
+  uint64 stalls;
+
+  CacheHierarchy(const string & spec);
+  ~CacheHierarchy();
+  void access(uint32 addr, byte kind, bool write);
+  void report(ostream & out, uint64 cycles) const;
+  bool matches(const CacheHierarchy & other) const;
+};
+
+/**
+ * Times an access to main memory.
+ *
+ * @param addr  The word accessed.
+ * @param kind  ACCESS_INST, ACCESS_AM or ACCESS_DATA.
+ * @param write Whether it was a write.
+ */
+inline void CacheHierarchy::access(uint32 addr, byte kind, bool write) {
+  Cache * cache = top[kind != ACCESS_INST];
+  uint32 ticks = cache ? cache->access(addr, kind, write) : memory_latency;
+  if(ticks > 1)
+    stalls += ticks - 1;
+}
+
+#endif
@@ -0,0 +1,72 @@
+/**
+ * File: ControlStore.h
+ *
+ * Authors: Benjamin David Mayes <bdm8233@rit.edu>
+ *          Colin Alexander Barr <colin.a.barr@gmail.com>
+ *
+ * Description: Declarations for the predecoded copy of micro-memory.
+ */
+
+#ifndef CONTROLSTORE_H
+#define CONTROLSTORE_H
+
+#include "globals.h"
+
+// The fields AMmodify fills into an address mode micro-op
+#define AM_FILL_AI_HIGH 0x1 // AM index into bits 5..4
+#define AM_FILL_AI      0x2 // AM index into bits 1..0
+#define AM_FILL_RI      0x4 // register index (from mAUX) into bits 3..0
+
+// Clock ticks taken by the parts of an instruction outside of micro-words
+const uint32 GOTO_FETCH_TICKS = 3;  // gotoFetch()
+const uint32 AM_SETUP_TICKS = 1;    // loading mAUX at the start of AM()
+const uint32 AM_SKIP_TICKS = 1;     // shifting past a field that is no address mode
+const uint32 AM_DISPATCH_TICKS = 3; // entering an address mode routine and shifting past it
+const uint32 DECODE_TICKS = 2;      // decode()
+const uint32 WRITEBACK_TICKS = 1;   // writeback()
+const uint32 MICRO_WORD_TICKS = 3;  // mFetch() and mExecute() of a micro-word
+const uint32 HALT_TICKS = 2;        // mFetch() of the micro-word that halts
+
+// A decoded micro-op, one of the three byte fields of a micro-word
+struct MicroOp {
+  byte inst;      // the micro-op as stored in micro-memory
+  byte func;      // its index into the microInst table
+  byte am_base;   // the micro-op with the fields AMmodify fills in cleared
+  byte am_fill;   // the AM_FILL_* fields AMmodify fills in
+};
+
+// A decoded micro-word
+struct MicroWord {
+  byte flags;     // the control bits in the upper byte
+  MicroOp op[3];
+};
+
+// micro-memory decoded once when it is loaded, along with how many clock
+// ticks each part of an instruction takes to run through it
+class ControlStore {
+private:
+  MicroWord * words;
+  uint32 fetch_ticks;
+  uint32 am_ticks[256];
+  uint32 exec_ticks[256];
+  uint32 writeback_ticks[256];
+  uint32 routineTicks(uint32 addr, byte end_mask, byte end_flags, uint32 * writeback) const;
+public:
+  ControlStore();
+  ~ControlStore();
+  void load(const char * file);
+  const MicroWord & operator [] (uint32 addr) const;
+  uint32 fetchTicks() const;
+  uint32 amTicks(byte am) const;
+  uint32 execTicks(byte inst) const;
+  uint32 writebackTicks(byte inst) const;
+};
+
+// every possible micro-op byte, decoded
+extern MicroOp microOps[256];
+
+void setupMicroOps();
+MicroOp decodeMicroOp(byte inst);
+MicroWord decodeMicroWord(uint32 word, const MicroOp * ops);
+
+#endif
@@ -0,0 +1,169 @@
+/**
+ * File: FastCPU.h
+ *
+ * Authors: Benjamin David Mayes <bdm8233@rit.edu>
+ *          Colin Alexander Barr <colin.a.barr@gmail.com>
+ *
+ * Description: Declarations for the fast execution engine, a direct
+ * interpreter of the instruction set that works on plain register and memory
+ * arrays instead of the ArchLib bus model.
+ */
+
+#ifndef FASTCPU_H
+#define FASTCPU_H
+
+#include "globals.h"
+#include "ControlStore.h"
+
+// number of words in main memory (the MAR is 16 bits wide)
+const uint32 MEM_WORDS = 0x10000;
+const uint32 MEM_MASK = MEM_WORDS - 1;
+
+// the most words of memory a translated block may cover
+const uint32 BLOCK_WORDS = 256;
+
+// the most words one instruction can occupy (three double indexed operands)
+const uint32 INST_WORDS = 7;
+
+class FastCPU;
+class Pipeline;
+class CacheHierarchy;
+struct Translated;
+
+// runs the execute stage of a translated instruction
+typedef void (FastCPU::*Handler)(const Translated &);
+// resolves one address mode field of a translated instruction
+typedef void (FastCPU::*Resolver)(uint32, const Translated &);
+
+// An instruction decoded into handlers bound to its opcode and address modes
+struct Translated {
+  uint32 ir;
+  Handler exec;
+  Resolver resolve[3];  // 0 for fields that are not address modes
+  uint32 index[3][2];   // index words read from the instruction stream
+  uint32 length;        // words the instruction occupies
+  int error;            // the error the instruction raises, or -1
+  uint32 ticks;         // clock ticks the microcoded CPU takes to run it
+};
+
+// A run of translated instructions ending at a jump or a halt
+struct Block {
+  uint32 start;         // the address of the first instruction
+  uint32 end;           // one past the last word covered
+  uint32 count;
+  Translated * code;
+};
+
+// The architectural state of the CPU and an interpreter that executes the
+// instruction set directly on it.
+class FastCPU {
+public:
+  // registers
+  uint32 pc;
+  uint32 ir;
+  uint32 imm;
+  uint32 mar;
+  uint32 r[16];
+  uint32 amr[4];
+
+  // main memory
+  uint32 * mem;
+
+  // the address of the instruction being executed
+  uint32 prev_pc;
+
+  // the addresses read from and the writes to main memory made by the last
+  // instruction
+  uint32 reads[8];
+  uint32 read_count;
+  uint32 field_reads[3];  // read_count after each field was resolved
+  MemWrite writes[2];
+  uint32 write_count;
+
+  // every write to main memory is also added to the end of this, if set
+  list<MemWrite> * write_log;
+
+  // the timing model told about each instruction as it completes, if any
+  Pipeline * pipeline;
+
+  // the caches its memory accesses are timed through, if any
+  CacheHierarchy * caches;
+
+  // instructions completed, and the clock ticks the microcoded CPU would
+  // have taken for everything executed (when there is a control store)
+  uint64 instructions;
+  uint64 cycles;
+
+  // block cache statistics
+  uint64 hits;
+  uint64 misses;
+  uint64 invalidations;
+
+  FastCPU(const ControlStore * control = 0);
+  ~FastCPU();
+  void load(const char * file);
+  void overlay(const char * file);
+  void save(const char * file) const;
+  void step();
+  void run(uint64 limit);
+  uint64 runBlock(uint64 limit);
+  void flush();
+
+private:
+  // micro-memory, shared with every other CPU and only read from
+  const ControlStore * control;
+
+  // translated blocks by start address, and how many blocks cover each word
+  Block ** blocks;
+  unsigned short * covered;
+  list<Block *> retired;
+  bool invalidated;
+
+  void translate(uint32 addr, Translated & t);
+  Block * translateBlock(uint32 addr);
+  void invalidate(uint32 addr);
+  void retire(Block * block);
+  void execute(const Translated & t);
+  void writeback(const Translated & t);
+  void timeAccesses(const Translated & t);
+  uint32 read(uint32 addr);
+  void write(uint32 addr, uint32 value);
+
+  // address mode handlers
+  void resolveRegister(uint32 ai, const Translated & t);
+  void resolveRegisterIndirect(uint32 ai, const Translated & t);
+  void resolveMemoryIndirect(uint32 ai, const Translated & t);
+  void resolveIndexed(uint32 ai, const Translated & t);
+  void resolveIndexedIndirect(uint32 ai, const Translated & t);
+  void resolveIndexedMemoryIndirect(uint32 ai, const Translated & t);
+  void resolveDoubleIndexed(uint32 ai, const Translated & t);
+
+  // execute handlers
+  void execAdd(const Translated & t);
+  void execSub(const Translated & t);
+  void execNeg(const Translated & t);
+  void execOr(const Translated & t);
+  void execAnd(const Translated & t);
+  void execXor(const Translated & t);
+  void execCmp(const Translated & t);
+  void execShift(const Translated & t);
+  void execInc(const Translated & t);
+  void execDec(const Translated & t);
+  void execJmp(const Translated & t);
+  void execJumpCompare(const Translated & t);
+  void execJumpZero(const Translated & t);
+  void execMov(const Translated & t);
+  void execPush(const Translated & t);
+  void execPop(const Translated & t);
+  void execHalt(const Translated & t);
+};
+
+/**
+ * Reads a word from main memory, recording the read.
+ */
+inline uint32 FastCPU::read(uint32 addr) {
+  reads[read_count++] = addr;
+  return mem[addr];
+}
+
+#endif
@@ -0,0 +1,81 @@
+/**
+ * File: Image.h
+ *
+ * Authors: Benjamin David Mayes <bdm8233@rit.edu>
+ *          Colin Alexander Barr <colin.a.barr@gmail.com>
+ *
+ * Description: Declarations for loading memory, either from object files or
+ * from binary images, which are mapped straight into the address space, and
+ * for writing images and snapshots of the fast engine.
+ */
+
+#ifndef IMAGE_H
+#define IMAGE_H
+
+#include "globals.h"
+
+// Kinds of image
+#define IMAGE_PROGRAM  0  // memory and a start address
+#define IMAGE_SNAPSHOT 1  // memory and the whole state of a CPU part way through
+
+// The start of an image file. It is followed by the MachineState of a
+// snapshot, and then by each segment with its words.
+struct ImageHeader {
+  char magic[4];    // "MIMG"
+  uint32 kind;
+  uint32 start;     // the start address
+  uint32 segments;
+};
+
+// A run of words in memory
+struct ImageSegment {
+  uint32 addr;
+  uint32 count;
+};
+
+// The state of a CPU between instructions, where the micro-state is always
+// the start of the fetch routine
+struct MachineState {
+  uint32 pc;
+  uint32 ir;
+  uint32 imm;
+  uint32 mar;
+  uint32 r[16];
+  uint32 amr[4];
+  uint64 instructions;
+  uint64 cycles;
+};
+
+// An image file, mapped into memory for as long as it is open
+class Image {
+private:
+  char * data;
+  uint32 size;
+public:
+  const ImageHeader * header;
+  const MachineState * state;   // 0 unless it is a snapshot
+
+  Image(const char * file);
+  ~Image();
+  uint32 copy(uint32 * words, uint32 count) const;
+};
+
+// the IMAGE_* kind of a file, or -1 if it is not an image
+int image_kind(const char * file);
+
+// writes the non-zero words of memory to an image
+void write_image(const char * file, uint32 start, const uint32 * words, uint32 count,
+                 const MachineState * state = 0);
+
+// reads an object file or image into an array of words, returning its start
+// address
+uint32 load_obj(const char * file, uint32 * words, uint32 size);
+
+// the number of words an object file can address (the MAR is 16 bits wide)
+const uint32 OBJ_WORDS = 0x10000;
+
+// loads an object file or image into ArchLib memory, or changes what it holds
+void load_memory(Memory & memory, const char * file);
+void store_memory(Memory & memory, const uint32 * words, const uint32 * held, uint32 start);
+
+#endif
@@ -0,0 +1,79 @@
+/**
+ * File: Pipeline.h
+ *
+ * Authors: Benjamin David Mayes <bdm8233@rit.edu>
+ *          Colin Alexander Barr <colin.a.barr@gmail.com>
+ *
+ * Description: Declarations for the pipelined timing model, which works out
+ * how long a program would take if the fetch, decode, execute and writeback
+ * of successive instructions overlapped.
+ */
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include "globals.h"
+#include "ControlStore.h"
+#include "FastCPU.h"
+
+// Forwarding paths
+#define FORWARD_EXECUTE 0x1 // results to decode as soon as they are computed
+#define FORWARD_MEMORY  0x2 // stores to later loads of the same address
+
+// Branch predictors
+#define PREDICT_NONE      0 // fetch waits for every jump to be resolved
+#define PREDICT_NOT_TAKEN 1
+#define PREDICT_TAKEN     2 // to the target the jump last went to
+#define PREDICT_BIMODAL   3 // two bit counters, with the last target
+
+// Causes of stalls
+#define STALL_REGISTER   0 // waiting on a register being written
+#define STALL_MEMORY     1 // waiting on memory being written
+#define STALL_STRUCTURAL 2 // waiting for the next stage to be free
+#define STALL_CONTROL    3 // waiting for a jump to be resolved, if mispredicted or not predicted
+#define STALL_CAUSES     4
+
+// A timing model of a four stage pipeline, fed each instruction the fast
+// engine completes. Each stage takes as many ticks as the microcode spends
+// in it and holds one instruction at a time. Jumps are resolved at the end
+// of execute.
+class Pipeline {
+private:
+  const ControlStore & control;
+  uint32 forwarding;
+  uint32 predictor;
+
+  // the ticks the last instruction started each stage at, and when its
+  // writeback finished
+  uint64 fetch_start, decode_start, execute_start, writeback_start, writeback_end;
+  // the earliest the next instruction can be fetched
+  uint64 fetch_ready;
+
+  // when registers and memory words can next be read
+  uint64 reg_ready[16];
+  uint64 * mem_ready;
+
+  // the predictor's two bit counters, and the address and last target of
+  // the jump each entry was last used for
+  uint32 table_mask;
+  byte * counters;
+  uint32 * tags;
+  uint32 * targets;
+
+  uint64 enter(uint64 natural, uint64 busy, uint64 reg, uint64 mem);
+  bool predict(uint32 pc, bool taken, uint32 target);
+
+public:
+  uint64 instructions;
+  uint64 cycles;
+  uint64 stalls[STALL_CAUSES];
+  uint64 jumps;
+  uint64 mispredicts;
+
+  Pipeline(const ControlStore & control, uint32 forwarding, uint32 predictor, uint32 table_size);
+  ~Pipeline();
+  void retire(const FastCPU & cpu, const Translated & t);
+  void stopped(const FastCPU & cpu, const Translated & t);
+};
+
+#endif
@@ -0,0 +1,73 @@
+/**
+ * File: Profile.h
+ *
+ * Authors: Benjamin David Mayes <bdm8233@rit.edu>
+ *          Colin Alexander Barr <colin.a.barr@gmail.com>
+ *
+ * Description: Declarations for the guest profiler, which counts how often
+ * each instruction of a program ran on the microcoded CPU and the micro-ops
+ * and clock ticks it took, split by opcode, address and stage.
+ */
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "globals.h"
+
+#include <map>
+
+// The stages an instruction's ticks are split into. Resolving each address
+// mode field is counted against its mode, not a stage.
+#define PROFILE_FETCH   0   // gotoFetch() and the fetch micro-words
+#define PROFILE_DECODE  1   // AM() outside the address mode routines, and decode()
+#define PROFILE_EXECUTE 2   // the execute micro-words and writeback()
+#define PROFILE_STAGES  3
+
+// Address modes, by the upper four bits of their field less 8
+#define PROFILE_MODES   7
+
+// What a part of the program cost
+struct ProfileCount {
+  uint64 count;
+  uint64 micro_ops;
+  uint64 cycles;
+};
+
+// What an instruction at one address with one opcode cost
+struct ProfileEntry {
+  ProfileCount total;
+  ProfileCount stages[PROFILE_STAGES];
+  ProfileCount modes[PROFILE_MODES];
+};
+
+// Counts the cost of each instruction the microcoded CPU runs, told when it
+// starts, finishes fetch and decode, resolves an address mode and finishes.
+class Profiler {
+private:
+  // by address above the low byte and opcode in it, so that an address that
+  // is written over with a different instruction is kept apart
+  map<uint64, ProfileEntry> entries;
+
+  // the instruction being run, and the counters where its stages started
+  uint64 key;
+  bool running;
+  // the instructions that stopped the CPU, which never finished
+  uint64 stops;
+  uint64 stage_cycles, stage_ops;
+  ProfileEntry current;
+
+  void stage(uint32 which, uint64 cycles, uint64 micro_ops);
+
+public:
+  Profiler();
+  void begin(uint32 pc, uint64 cycles, uint64 micro_ops);
+  void fetched(uint32 ir, uint64 cycles, uint64 micro_ops);
+  void addressMode(byte am, uint64 cycles, uint64 micro_ops);
+  void decoded(uint64 cycles, uint64 micro_ops);
+  void end(uint64 cycles, uint64 micro_ops);
+  void stopped(uint64 cycles, uint64 micro_ops);
+  void report(ostream & out) const;
+  void fold(ostream & out) const;
+};
+
+#endif
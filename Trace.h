@@ -0,0 +1,116 @@
+/**
+ * File: Trace.h
+ *
+ * Authors: Benjamin David Mayes <bdm8233@rit.edu>
+ *          Colin Alexander Barr <colin.a.barr@gmail.com>
+ *
+ * Description: Declarations for the structured trace: fixed-size records of
+ * what the microcoded CPU did, a buffer that captures them to a file, and the
+ * formatter that turns them back into readable trace output.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "globals.h"
+
+#include <fstream>
+
+// Kinds of trace record
+#define TRACE_OP    0   // a micro-op ran
+#define TRACE_WORD  1   // a micro-word finished, after the micro-ops it ran
+#define TRACE_INST  2   // an instruction finished, after the micro-words it ran
+#define TRACE_STOP  3   // the CPU stopped, with the ERR_* in op; a halt is
+                        // finished by this rather than a TRACE_INST
+
+// The stages of an instruction
+#define TRACE_FETCH     0
+#define TRACE_DECODE    1
+#define TRACE_EXECUTE   2
+#define TRACE_WRITEBACK 3
+#define TRACE_STAGES    4
+
+// set in the op of a TRACE_WORD record for a conditional jump that was taken
+#define TRACE_TAKEN 0x1
+
+// set in the flags of a trace file that only holds the last of the records
+#define TRACE_WRAPPED 0x1
+
+// A single trace record
+struct TraceRecord {
+  uint64 cycle;     // clock ticks before the record was made
+  uint32 pc;        // the address of the instruction
+  uint32 ir;
+  uint32 word;      // the micro-word in the MIR
+  byte kind;
+  byte stage;
+  byte op;          // TRACE_OP: the micro-op as run, TRACE_WORD: TRACE_TAKEN
+  byte func;        // TRACE_OP: its index into the microInst table
+  uint32 value[2];  // TRACE_OP: the values it read (from trace_values)
+};
+
+// The start of a trace file
+struct TraceHeader {
+  char magic[4];
+  uint32 record_size;
+  uint32 flags;
+  uint32 reserved;
+  uint64 records;
+};
+
+// Captures trace records to a file, either streaming all of them through a
+// preallocated buffer or keeping only the last of them in it as a ring.
+class TraceBuffer {
+private:
+  TraceRecord * records;
+  uint32 mask;
+  uint64 total;     // records made
+  uint64 written;   // records written to the file
+  bool ring;
+  ofstream out;
+  void write(uint64 from, uint64 to);
+public:
+  TraceBuffer(uint32 size);
+  ~TraceBuffer();
+  void open(const char * file, bool ring);
+  void close();
+  TraceRecord & next();
+};
+
+// Rebuilds the Fetch/Decode/Execute/Writeback trace from records, printing
+// each instruction as its TRACE_INST record arrives.
+class TraceFormatter {
+private:
+  ostream & out;
+  bool verbose;
+  uint32 pc_low, pc_high;
+  int opcode;
+  TraceRecord ops[3];   // the micro-ops of the micro-word being run
+  uint32 op_count;
+  list<string> lines[TRACE_STAGES];
+  string side_effect;
+  void word(const TraceRecord & t);
+public:
+  TraceFormatter(ostream & out, bool verbose);
+  void filter(uint32 pc_low, uint32 pc_high, int opcode);
+  void add(const TraceRecord & t);
+  void discard();
+};
+
+/**
+ * Hands out the next record to fill in, writing the buffer out to the file
+ * first when it is full.
+ */
+inline TraceRecord & TraceBuffer::next() {
+  if(!ring && total - written > mask)
+    write(written, total);
+  return records[total++ & mask];
+}
+
+// text for the parts of a trace
+string format_micro_op(const TraceRecord & t);
+string get_inst_mnemonic(byte inst);
+string resolve_address_modes(uint32 inst);
+string stop_message(int err_code, uint32 ir, uint32 pc);
+
+#endif
@@ -19,13 +19,25 @@
 #define ERR_HALT            0
 #define ERR_INVALID_AM      1
 #define ERR_INVALID_OPCODE  2
+#define ERR_LOAD            3
+#define ERR_CHECK_FAILED    4
+#define ERR_TRACE_FILE      5
+#define ERR_CACHE_CONFIG    6
+#define ERR_SAVE            7
 
 // convenient typedefs
 typedef unsigned char byte;
 typedef unsigned int uint32;
+typedef unsigned long long uint64;
+
+// a single write to main memory
+struct MemWrite {
+  uint32 addr;
+  uint32 value;
+};
 
 // a function called to run micro instructions
-typedef string(*MicroInst)(byte);
+typedef void(*MicroInst)(byte);
 
 // A class that wraps a register file
 class RegisterFile {
@@ -73,7 +85,35 @@ extern Memory mmem;
 // the list of micro instructions
 extern MicroInst microInst[NUMBER_MICRO_FUNCTIONS];
 
+// main memory writes made by the current instruction (only kept when
+// log_writes is set)
+extern bool log_writes;
+extern list<MemWrite> mem_writes;
+
+// the caches main memory accesses are timed through, if any, and the kind of
+// access (from Cache.h) reads made by micro-ops other than fetches are
+class CacheHierarchy;
+extern CacheHierarchy * mem_caches;
+extern byte access_kind;
+
+// whether micro-ops record the values they read for the trace; building with
+// NO_TRACE turns every check of it into a constant
+#ifdef NO_TRACE
+const bool tracing = false;
+#else
+extern bool tracing;
+#endif
+extern uint32 trace_values[2];
+
+// records the values a micro-op read, when tracing
+#define TRACE_VALUES(a, b) \
+  do { if(tracing) { trace_values[0] = (a); trace_values[1] = (b); } } while(0)
+
 // creates connections in the CPU
 void makeConnections();
 
+// instruction validity checks shared by the execution engines
+void opcode_check(byte inst);
+void AM_check(byte inst, byte * am);
+
 #endif
@@ -3,5 +3,5 @@ ARCHVER = arch2-5a
 CXX = /opt/SUNWspro/bin/CC
 CCFLAGS = +w -g -xsb -I$(BASE)/include/$(ARCHVER)
 CXXFLAGS = $(CCFLAGS)
-LIBFLAGS = -g -L$(BASE)/lib/$(SYSTEM_TYPE) -l$(ARCHVER)
+LIBFLAGS = -g -L$(BASE)/lib/$(SYSTEM_TYPE) -l$(ARCHVER) -lpthread
 CCLIBFLAGS = $(LIBFLAGS)